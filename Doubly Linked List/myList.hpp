@@ -1,7 +1,11 @@
 #ifndef MY_LIST_HPP_
 #define MY_LIST_HPP_
 
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <utility>
 
 template <typename T>
 class MyList  {
@@ -11,10 +15,74 @@ class MyList  {
     Node* prev {nullptr};
     Node* next {nullptr};
     Node(T input_data = T {}, Node* prevNode = nullptr,
-      Node* nextNode = nullptr) : data {input_data}, prev {prevNode},
+      Node* nextNode = nullptr) : data {std::move(input_data)}, prev {prevNode},
                                   next {nextNode} {}
   };
 
+  class const_iterator;
+
+  // Bidirectional iterator over the list. It stays valid until the node it
+  // points to is erased, no matter what else is pushed, moved or erased.
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    iterator() = default;
+
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+
+    iterator& operator++() { node = node->next; return *this; }
+    iterator operator++(int) { iterator old = *this; ++*this; return old; }
+    // end() holds no node, so stepping back from it lands on the tail
+    iterator& operator--() { node = node ? node->prev : list->tail; return *this; }
+    iterator operator--(int) { iterator old = *this; --*this; return old; }
+
+    bool operator==(const iterator& other) const { return node == other.node; }
+    bool operator!=(const iterator& other) const { return node != other.node; }
+
+   private:
+    friend class MyList;
+    friend class const_iterator;
+    iterator(Node* n, const MyList* l) : node {n}, list {l} {}
+    Node* node {nullptr};
+    const MyList* list {nullptr};
+  };
+
+  // Same as iterator, but for reading a const MyList
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator() = default;
+    const_iterator(iterator it) : node {it.node}, list {it.list} {}
+
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+
+    const_iterator& operator++() { node = node->next; return *this; }
+    const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+    const_iterator& operator--() { node = node ? node->prev : list->tail; return *this; }
+    const_iterator operator--(int) { const_iterator old = *this; --*this; return old; }
+
+    bool operator==(const const_iterator& other) const { return node == other.node; }
+    bool operator!=(const const_iterator& other) const { return node != other.node; }
+
+   private:
+    friend class MyList;
+    const_iterator(const Node* n, const MyList* l) : node {n}, list {l} {}
+    const Node* node {nullptr};
+    const MyList* list {nullptr};
+  };
+
 private:
   // Define a head and tail to track the ends of the list,
   // and a size int which tracks the size of the list.
@@ -69,7 +137,480 @@ private:
   // return the number of elements in the list
   int size() const;
 
-  // Define any additional member functions?
+  // iterators to the first element, and to one past the last element
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // remove the element at pos in O(1), returning an iterator to the element after it
+  // only iterators to the erased element are invalidated
+  iterator erase(iterator pos);
+  // relink the element at pos to the front of the list in O(1)
+  // pos (and every other iterator) stays valid and still points to the same element
+  void move_to_front(iterator pos);
+  // move the element at it out of other and into this list in front of pos, in O(1)
+  // the node itself moves, so nothing is copied or allocated and it stays valid
+  void splice(iterator pos, MyList& other, iterator it);
+
+  // -- Ordering operations --
+  // None of these copy or allocate any T, they only relink prev/next pointers.
+
+  // These are templates, so T only needs operator< or operator== if they are actually used.
+
+  // sort the list in ascending order (by operator< unless a comparison is given)
+  // bottom-up merge sort: stable, O(n log n), O(1) extra memory
+  template <typename Compare = std::less<>>
+  void sort(Compare less = Compare {});
+  // merge the sorted list other into this sorted list, leaving other empty
+  // on ties, elements already in this list come first
+  template <typename Compare = std::less<>>
+  void merge(MyList& other, Compare less = Compare {});
+  // remove consecutive duplicate elements (by operator== unless a comparison is given)
+  template <typename Equal = std::equal_to<>>
+  void unique(Equal equal = Equal {});
+  // remove every element for which pred(element) is true
+  template <typename Predicate>
+  void remove_if(Predicate pred);
+
+ private:
+  // unlink node from the list, delete it, and return the node that came after it
+  Node* eraseNode(Node* node);
+  // take node out of the list without deleting it
+  void unlinkNode(Node* node);
+  // put an unlinked node into the list in front of before (nullptr means at the back)
+  void linkBefore(Node* node, Node* before);
+  // cut the chain starting at start after count nodes, and return the rest
+  static Node* splitAfter(Node* start, int count);
+  // merge two sorted chains linked through next, returning the new start and setting last
+  template <typename Compare>
+  static Node* mergeChains(Node* left, Node* right, Node*& last, Compare& less);
+  // walk the chain from head, fixing every prev pointer and the tail
+  void relinkPrev();
 };
 
+// default constructor
+template <typename T>
+MyList<T>::MyList() {
+  head = nullptr;
+  tail = nullptr;
+}
+
+// copy constructor
+template <typename T>
+MyList<T>::MyList(const MyList& other) : head(nullptr), tail(nullptr) {
+  size_ = 0;
+  // Create a new node based on the start of the original list.
+  Node* current = other.head;
+  // Transverse through the list until we're pointing to a nullptr.
+  while (current != nullptr) {
+    // Add the data to the current node by using push_back.
+    push_back(current->data);
+    // Go to the next node.
+    current = current->next;
+  }
+}
+
+// assignment operator
+template <typename T>
+MyList<T>& MyList<T>::operator=(MyList other) {
+  // Copy the data, swap it, and then the library clears it from memory.
+  // Simple way of doing assignment!
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(size_, other.size_);
+  return *this;
+}
+
+// destructor
+template <typename T>
+MyList<T>::~MyList() {
+  Node* del = head;
+  // Delete each and every node to prevent memory leaks.
+  while (del) {
+    // We use current and not head so that we are not pointing to any nullptrs,
+    // and while (current) is the same as while (current != nullptr). This makes sure
+    // that we don't access any memory we shouldn't.
+    Node* temp = del;
+    del = del->next;
+    delete temp;
+  }
+  size_ = 0; // The size is now empty!
+  head = nullptr; // All nodes are gone, so the head should be moved to a nullptr.
+}
+
+// constructor from an initializer list
+template <typename T>
+MyList<T>::MyList(std::initializer_list<T> vals) {
+  // For each element in our list of vals (of any type)
+  // we push it to back of the list.
+  for (const T& val : vals) {
+    push_back(val);
+  }
+}
+
+// push back
+template <typename T>
+void MyList<T>::push_back(T val) {
+  // Create a new node containing the value
+  // Move val into the new node, so the element is only copied once (when it was passed in)
+  Node* node = new Node(std::move(val));
+  // Increase the size of the list by one, as we're about to insert one item into it.
+  ++size_;
+  if (tail) {
+    // Add the node to the back of the list and fix up where the next and previous are pointing to.
+    tail->next = node;
+    node->prev = tail;
+  }
+  // We make the new node be the head if the list is empty.
+  if (!head) head = node;
+  // Now since we are pushing to the back, we know the tail must now be this node.
+  // So, set the tail as the new node.
+  tail = node;
+}
+
+// pop back
+template <typename T>
+void MyList<T>::pop_back() {
+  // If the list is empty, we should escape this function.
+  // This is our guard.
+  if (!tail) return;
+
+  // We are removing one node (and can as of above!), so decrease the size by 1.
+  --size_;
+
+  // We are going to delete this node, so store it as another variable.
+  Node* del = tail;
+  // Move tail back one
+  tail = tail->prev;
+  // Delete what comes after the tail, so it is the end
+  if (tail) {
+    tail->next = nullptr;
+  } else {
+    head = nullptr;
+  }
+  // Delete the old tail, goodbye memory leak.
+  delete del;
+}
+
+// push front
+template <typename T>
+void MyList<T>::push_front(T val) {
+  // Create a new node containing the value
+  Node* node = new Node(std::move(val));
+  // Increase the size of the list by one, as we're about to insert one item into it.
+  ++size_;
+  if (head) {
+    // Add the node to the front of the list and fix up where the next and previous are pointing to.
+    head->prev = node;
+    node->next = head;
+  }
+  // We make the new node be the tail if the list is empty. (We also make it be the head but in every case,
+  // so we don't need to do it in this if statement and repeat ourselves!).
+  if (!tail) tail = node;
+  // Now since we are pushing to the front, we know the head must now be this node.
+  // So, set the head as the new node.
+  head = node;
+}
+
+// pop front
+template <typename T>
+void MyList<T>::pop_front() {
+  // If the list is empty, we should escape this function.
+  // This is our guard.
+  if (!head) return;
+
+  // We are removing one node (and can as of above!), so decrease the size by 1.
+  --size_;
+  // We are going to delete this node, so store it as another variable.
+  Node* del = head;
+  // Move head forward one
+  head = head->next;
+  // Delete what comes before the head, so it is the start
+  if (head) {
+    head->prev = nullptr;
+  } else {
+    tail = nullptr;
+  }
+  // Delete the old head, goodbye memory leak.
+  delete del;
+}
+
+
+// return the first element by reference
+template <typename T>
+T& MyList<T>::front() {
+  // Return the data in the head!
+  return head->data;
+}
+
+// return the first element by const reference
+template <typename T>
+const T& MyList<T>::front() const {
+  // Return the data in the head! BUT THIS TIME IT IS A CONST 😱😱😱😱😱
+  return head->data;
+}
+
+// return the last element by reference
+template <typename T>
+T& MyList<T>::back() {
+  // Return the data in the tail, what a surprise!
+  return tail->data;
+}
+
+// return the last element by const reference
+template <typename T>
+const T& MyList<T>::back() const {
+  // Return the data in the tail. But get this, we do it as a const. 🤯🤯🤯
+  return tail->data;
+}
+
+// is the list empty?
+template <typename T>
+bool MyList<T>::empty() const {
+  // We use our Super Useful (TM) size() function.
+  // If the size is 0, we know it's empty! If it is anything else, it is not empty!
+  // So, we return if the size is 0 or not, woohoo.
+  return size() == 0;
+}
+
+// return the number of elements in the list
+template <typename T>
+int MyList<T>::size() const {
+  // We return the size_ int which we have been automatically updating with push/pop etc.
+  return size_;
+}
+
+// iterator to the first element
+template <typename T>
+typename MyList<T>::iterator MyList<T>::begin() {
+  return iterator(head, this);
+}
+
+// iterator one past the last element, which holds no node at all
+template <typename T>
+typename MyList<T>::iterator MyList<T>::end() {
+  return iterator(nullptr, this);
+}
+
+template <typename T>
+typename MyList<T>::const_iterator MyList<T>::begin() const {
+  return const_iterator(head, this);
+}
+
+template <typename T>
+typename MyList<T>::const_iterator MyList<T>::end() const {
+  return const_iterator(nullptr, this);
+}
+
+// erase the element an iterator points to
+template <typename T>
+typename MyList<T>::iterator MyList<T>::erase(iterator pos) {
+  // The node knows its neighbours, so there's no need to search for it. O(1)!
+  return iterator(eraseNode(pos.node), this);
+}
+
+// move the element an iterator points to, to the front
+template <typename T>
+void MyList<T>::move_to_front(iterator pos) {
+  Node* node = pos.node;
+  // Already at the front (or nothing to move), so nothing to do.
+  if (!node || node == head) return;
+  // Unlink the node. It isn't the head, so it definitely has a prev.
+  node->prev->next = node->next;
+  if (node->next) {
+    node->next->prev = node->prev;
+  } else {
+    tail = node->prev;
+  }
+  // Relink it in front of the old head. We reuse the same node, so nothing is copied.
+  node->prev = nullptr;
+  node->next = head;
+  head->prev = node;
+  head = node;
+}
+
+// move a node from another list into this one
+template <typename T>
+void MyList<T>::splice(iterator pos, MyList& other, iterator it) {
+  Node* node = it.node;
+  // Splicing a node in front of itself leaves everything where it was.
+  if (!node || node == pos.node) return;
+  other.unlinkNode(node);
+  linkBefore(node, pos.node);
+}
+
+// unlink a node from wherever it is in the list and delete it
+template <typename T>
+typename MyList<T>::Node* MyList<T>::eraseNode(Node* node) {
+  Node* next = node->next;
+  unlinkNode(node);
+  delete node;
+  return next;
+}
+
+// take a node out of the list, leaving it (and its data) alive
+template <typename T>
+void MyList<T>::unlinkNode(Node* node) {
+  // Point the neighbours past the node. If there is no neighbour on one side,
+  // the node was the head (or tail), so the neighbour becomes the new head (or tail).
+  if (node->prev) {
+    node->prev->next = node->next;
+  } else {
+    head = node->next;
+  }
+  if (node->next) {
+    node->next->prev = node->prev;
+  } else {
+    tail = node->prev;
+  }
+  node->prev = nullptr;
+  node->next = nullptr;
+  --size_;
+}
+
+// link a node that isn't in any list in front of before
+template <typename T>
+void MyList<T>::linkBefore(Node* node, Node* before) {
+  // With no node to go in front of, the new node goes at the back.
+  Node* after = before ? before->prev : tail;
+  node->prev = after;
+  node->next = before;
+  if (after) {
+    after->next = node;
+  } else {
+    head = node;
+  }
+  if (before) {
+    before->prev = node;
+  } else {
+    tail = node;
+  }
+  ++size_;
+}
+
+// cut the chain after count nodes, returning the first node of the rest
+template <typename T>
+typename MyList<T>::Node* MyList<T>::splitAfter(Node* start, int count) {
+  // Walk forward count - 1 times so we land on the last node we keep.
+  for (int i = 1; start && i < count; ++i) {
+    start = start->next;
+  }
+  if (!start) return nullptr;
+  Node* rest = start->next;
+  start->next = nullptr;
+  return rest;
+}
+
+// fix up prev pointers and tail after relinking through next only
+template <typename T>
+void MyList<T>::relinkPrev() {
+  Node* previous = nullptr;
+  for (Node* current = head; current; current = current->next) {
+    current->prev = previous;
+    previous = current;
+  }
+  tail = previous;
+}
+
+
+// merge two sorted chains (only next pointers are used here)
+template <typename T>
+template <typename Compare>
+typename MyList<T>::Node* MyList<T>::mergeChains(Node* left, Node* right, Node*& last, Compare& less) {
+  Node* start = nullptr;
+  last = nullptr;
+  while (left && right) {
+    // Only take from the right when it is strictly smaller, this keeps the sort stable.
+    Node*& smaller = less(right->data, left->data) ? right : left;
+    if (last) {
+      last->next = smaller;
+    } else {
+      start = smaller;
+    }
+    last = smaller;
+    smaller = smaller->next;
+  }
+  // One chain ran out, so the rest of the other one is already in order.
+  Node* rest = left ? left : right;
+  if (last) {
+    last->next = rest;
+  } else {
+    start = rest;
+  }
+  // Move last to the real end of the merged chain.
+  while (last && last->next) last = last->next;
+  return start;
+}
+
+// sort the list
+template <typename T>
+template <typename Compare>
+void MyList<T>::sort(Compare less) {
+  if (size_ < 2) return;
+  // Bottom-up merge sort: merge runs of length 1, then 2, then 4, ...
+  // Each pass walks the list once, and we never need a stack or a buffer.
+  for (int width = 1; width < size_; width *= 2) {
+    Node* remaining = head;
+    Node* sortedHead = nullptr;
+    Node* sortedTail = nullptr;
+    while (remaining) {
+      Node* left = remaining;
+      Node* right = splitAfter(left, width);
+      remaining = splitAfter(right, width);
+      Node* mergedTail = nullptr;
+      Node* merged = mergeChains(left, right, mergedTail, less);
+      if (sortedTail) {
+        sortedTail->next = merged;
+      } else {
+        sortedHead = merged;
+      }
+      sortedTail = mergedTail;
+    }
+    head = sortedHead;
+  }
+  // The passes above only kept next pointers correct, so fix up prev and tail now.
+  relinkPrev();
+}
+
+// merge another sorted list into this one
+template <typename T>
+template <typename Compare>
+void MyList<T>::merge(MyList& other, Compare less) {
+  if (&other == this || !other.head) return;
+  Node* last = nullptr;
+  head = mergeChains(head, other.head, last, less);
+  relinkPrev();
+  size_ += other.size_;
+  // All of other's nodes belong to us now, so it must not delete them.
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.size_ = 0;
+}
+
+// remove consecutive duplicates
+template <typename T>
+template <typename Equal>
+void MyList<T>::unique(Equal equal) {
+  Node* current = head;
+  while (current && current->next) {
+    if (equal(current->next->data, current->data)) {
+      eraseNode(current->next);
+    } else {
+      current = current->next;
+    }
+  }
+}
+
+// remove every element matching pred
+template <typename T>
+template <typename Predicate>
+void MyList<T>::remove_if(Predicate pred) {
+  Node* current = head;
+  while (current) {
+    // eraseNode hands back the next node, so we never touch a deleted one
+    current = pred(current->data) ? eraseNode(current) : current->next;
+  }
+}
+
 #endif    // MY_LIST_HPP_
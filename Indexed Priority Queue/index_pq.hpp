@@ -7,6 +7,9 @@
 
 #include <vector>
 #include <algorithm>
+#include <iostream>
+#include <functional>
+#include "../Linear Probing/linearProbing.hpp"
 
 template<typename T>
 class IndexPriorityQueue {
@@ -55,6 +58,72 @@ private:
     void setIndexToPosAsPq(int i);
 };
 
+// Sparse variant of IndexPriorityQueue.
+// Instead of dense int indices in [0, N], keys can be any hashable value (e.g. 64-bit IDs).
+// Memory and constructor cost grow with the number of live entries, not with the largest key,
+// and popped/erased keys leave nothing stale behind.
+template<typename T, typename Key = long long, typename Hash = std::hash<Key> >
+class SparseIndexPriorityQueue {
+private:
+    // One slot of the heap: the priority lives right next to its key, so we never look it up elsewhere.
+    // slot is where this entry sits in keyToPosition, so sifting can update it without hashing.
+    struct Entry {
+        T priority{};
+        Key key{};
+        std::size_t slot{};
+    };
+    // heap is 1-indexed like priorityQueue above (heap.at(0) is an unused placeholder)
+    // and is heap ordered on priority:
+    // heap.at(i).priority <= heap.at(2 * i).priority
+    // heap.at(i).priority <= heap.at(2 * i + 1).priority
+    std::vector<Entry> heap{};
+    // Flat open addressing hash index (linear probing), at most half full. The size is a power of two.
+    // keyToPosition.at(s) is the heap position of the key stored in slot s, or 0 if the slot is empty
+    // (position 0 is the placeholder, so it is never a real position).
+    // keyToPosition.at(heap.at(i).slot) = i
+    std::vector<int> keyToPosition{};
+    std::size_t mask{};
+    Hash hasher{};
+
+public:
+    SparseIndexPriorityQueue();
+
+    // Reserve room for the expected number of live entries up front (negative counts as 0)
+    explicit SparseIndexPriorityQueue(int expectedLive);
+
+    void push(const T &, const Key &);
+
+    void pop();
+
+    void erase(const Key &);
+
+    [[nodiscard]] bool contains(const Key &) const;
+
+    void changeKey(const T &, const Key &);
+
+    std::pair<T, Key> top() const;
+
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] int size() const;
+
+private:
+    void swim(int i);
+
+    void sink(int i);
+
+    void setKeyToPosAsHeap(int i);
+
+    // slot holding key, or the empty slot where it would go
+    std::size_t findSlot(const Key &key) const;
+
+    // empty a slot and shift later entries back so probing still finds them
+    void clearSlot(std::size_t i);
+
+    // resize keyToPosition to tableSize slots and put every live key back in
+    void rehash(std::size_t tableSize);
+};
+
 // -- Useful helper functions --
 int leftChild(int i) {
     return 2 * i;
@@ -227,5 +296,180 @@ void IndexPriorityQueue<T>::setIndexToPosAsPq(int i) {
     indexToPosition[priorityQueue[i]] = i;
 }
 
+// -- SparseIndexPriorityQueue member functions --
+
+// Default constructor
+template<typename T, typename Key, typename Hash>
+SparseIndexPriorityQueue<T, Key, Hash>::SparseIndexPriorityQueue() :
+        heap(1) // Only the unused placeholder at position 0, the queue is empty
+{
+    rehash(probeTableSize(0));
+}
+
+// Constructor reserving space for expectedLive entries, so pushing that many never reallocates
+template<typename T, typename Key, typename Hash>
+SparseIndexPriorityQueue<T, Key, Hash>::SparseIndexPriorityQueue(int expectedLive) :
+        heap(1)
+{
+    std::size_t live = expectedLive > 0 ? static_cast<std::size_t>(expectedLive) : 0;
+    heap.reserve(live + 1);
+    rehash(probeTableSize(live));
+}
+
+// Determine if the SparseIndexPriorityQueue is empty
+template<typename T, typename Key, typename Hash>
+bool SparseIndexPriorityQueue<T, Key, Hash>::empty() const {
+    return size() == 0;
+}
+
+// Return the size of the SparseIndexPriorityQueue
+template<typename T, typename Key, typename Hash>
+int SparseIndexPriorityQueue<T, Key, Hash>::size() const {
+    // Every slot except the placeholder at position 0 is a live entry
+    return static_cast<int>(heap.size()) - 1;
+}
+
+// Push a new element into SparseIndexPriorityQueue
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::push(const T &priority, const Key &key) {
+    std::size_t slot = findSlot(key);
+    if (keyToPosition[slot] != 0) {
+        std::cerr << "Key is already in queue" << '\n';
+        return;
+    }
+    // Grow before the table gets more than half full, then find the key's slot in the new table
+    if (2 * heap.size() > keyToPosition.size()) {
+        rehash(2 * keyToPosition.size());
+        slot = findSlot(key);
+    }
+    heap.push_back(Entry{priority, key, slot});     // Add the entry at the end of the heap (position size())
+    keyToPosition[slot] = size();
+    swim(size());                                   // Swim the new element up to where it should be
+}
+
+// Pop the top element from SparseIndexPriorityQueue
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::pop() {
+    if (empty()) {
+        std::cerr << "No elements in the queue" << '\n';
+        return;
+    }
+    clearSlot(heap[1].slot);                // The key we are popping is no longer in the queue
+    std::swap(heap[1], heap.back());        // Swap the top element with the last element
+    heap.pop_back();                        // Remove the old top, which is now at the back
+    if (not empty()) {
+        setKeyToPosAsHeap(1);               // Update the position of the element we moved to the top
+        sink(1);                            // and sink it down to where it should be
+    }
+}
+
+// Erase a specific key from SparseIndexPriorityQueue
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::erase(const Key &key) {
+    std::size_t slot = findSlot(key);
+    int pos = keyToPosition[slot];          // Get the position of the key to erase
+    if (pos == 0) {
+        std::cerr << "Element is not in queue" << '\n';
+        return;
+    }
+    clearSlot(slot);
+    std::swap(heap[pos], heap.back());      // Swap the element to erase with the last element
+    heap.pop_back();                        // and drop it
+    if (pos <= size()) {                    // If we didn't just erase the last element,
+        setKeyToPosAsHeap(pos);             // update the position of the element we swapped in
+        swim(pos);                          // and move it to where it should be
+        sink(pos);
+    }
+}
+
+// Return the top element of the queue as {priority, key}
+template<typename T, typename Key, typename Hash>
+std::pair<T, Key> SparseIndexPriorityQueue<T, Key, Hash>::top() const {
+    return std::make_pair(heap[1].priority, heap[1].key);
+}
+
+// Change the priority of some given key, pushing it if it is not in the queue yet
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::changeKey(const T &priority, const Key &key) {
+    int pos = keyToPosition[findSlot(key)];
+    if (pos == 0) {
+        push(priority, key);
+        return;
+    }
+    bool decreased = priority < heap[pos].priority;
+    heap[pos].priority = priority;
+    if (decreased) {
+        swim(pos);
+    } else {
+        sink(pos);
+    }
+}
+
+// Return whether the SparseIndexPriorityQueue contains some given key
+template<typename T, typename Key, typename Hash>
+bool SparseIndexPriorityQueue<T, Key, Hash>::contains(const Key &key) const {
+    return keyToPosition[findSlot(key)] != 0;
+}
+
+// Swim helper function for min heap property.
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::swim(int i) {
+    while (i > 1 and heap[i].priority < heap[parent(i)].priority) {
+        std::swap(heap[i], heap[parent(i)]);
+        setKeyToPosAsHeap(i);
+        setKeyToPosAsHeap(parent(i));
+        i = parent(i);
+    }
+}
+
+// Sink helper function for min heap property
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::sink(int i) {
+    while (leftChild(i) <= size()) {
+        int child = leftChild(i);
+        // Pick the right child instead if it exists and has the smaller priority
+        if (child < size() and heap[child].priority > heap[rightChild(i)].priority) {
+            ++child;
+        }
+        if (heap[i].priority <= heap[child].priority) {
+            return;
+        }
+        std::swap(heap[i], heap[child]);
+        setKeyToPosAsHeap(i);
+        setKeyToPosAsHeap(child);
+        i = child;
+    }
+}
+
+// Same idea as setIndexToPosAsPq: record that the key now at heap position i lives at position i.
+// The entry remembers its slot, so this is a plain store with no hashing.
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::setKeyToPosAsHeap(int i) {
+    keyToPosition[heap[i].slot] = i;
+}
+
+template<typename T, typename Key, typename Hash>
+std::size_t SparseIndexPriorityQueue<T, Key, Hash>::findSlot(const Key &key) const {
+    return probeFind(keyToPosition, hasher(key) & mask, [&](int pos) { return heap[pos].key == key; });
+}
+
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::clearSlot(std::size_t i) {
+    probeErase(keyToPosition, i,
+               [&](int pos) { return hasher(heap[pos].key) & mask; },
+               [&](std::size_t slot) { heap[keyToPosition[slot]].slot = slot; });  // The moved entry records its new slot
+}
+
+template<typename T, typename Key, typename Hash>
+void SparseIndexPriorityQueue<T, Key, Hash>::rehash(std::size_t tableSize) {
+    keyToPosition.assign(tableSize, 0);
+    mask = tableSize - 1;
+    for (int pos = 1; pos <= size(); ++pos) {
+        std::size_t slot = findSlot(heap[pos].key);
+        keyToPosition[slot] = pos;
+        heap[pos].slot = slot;
+    }
+}
+
 #endif  // INDEX_PRIORITY_QUEUE_HPP_
 
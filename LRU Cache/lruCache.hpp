@@ -0,0 +1,222 @@
+#ifndef LRU_CACHE_HPP_
+#define LRU_CACHE_HPP_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../Doubly Linked List/myList.hpp"
+#include "../Linear Probing/linearProbing.hpp"
+
+// Least recently used cache with a fixed capacity, built on MyList.
+//
+// The list keeps entries in recency order (front = most recently used) and the
+// index is a flat open addressing hash table holding iterators into the list,
+// so get/put/erase are O(1). Nodes are pooled: an erased entry's node is spliced
+// onto a spare list, and a full cache overwrites its least recently used node,
+// so the cache never holds more than capacity nodes and stops allocating once
+// it has reached capacity.
+template<typename K, typename V, typename Hash = std::hash<K> >
+class LruCache {
+private:
+    using Entry = std::pair<K, V>;
+    using ListIterator = typename MyList<Entry>::iterator;
+
+    // Entries in recency order, most recently used at the front
+    MyList<Entry> entries{};
+    // Nodes of erased entries, kept for reuse. entries.size() + spare.size() <= capacity_
+    MyList<Entry> spare{};
+    // Flat hash index: slots.at(i) is either an empty iterator or points to the entry whose key
+    // hashes to i (or, after collisions, to a slot before i). The size is a power of two.
+    std::vector<ListIterator> slots{};
+    std::size_t mask{};
+    int capacity_{};
+    Hash hasher{};
+
+    long long hits_{};
+    long long misses_{};
+    long long evictions_{};
+
+public:
+    // capacity is the maximum number of entries, and must be at least 1
+    explicit LruCache(int capacity);
+
+    // The index holds iterators into this cache's own list, so a member-wise copy would
+    // point into the original's nodes. Copying is disabled rather than rebuilding the index.
+    LruCache(const LruCache &) = delete;
+
+    LruCache &operator=(const LruCache &) = delete;
+
+    // return a pointer to the value for key (marking it most recently used), or nullptr on a miss
+    // the pointer stays valid until the entry is erased or evicted
+    V *get(const K &key);
+
+    // insert or update the value for key, and mark it most recently used
+    // evicts the least recently used entry if the cache is full
+    // value is moved into the cache, so pass an rvalue to avoid copying it at all
+    void put(const K &key, V value);
+
+    // remove key from the cache, returning whether it was there
+    // the node is kept for reuse, so its old value stays alive until it is overwritten
+    bool erase(const K &key);
+
+    // is key in the cache? Doesn't count as a use and doesn't touch the statistics
+    [[nodiscard]] bool contains(const K &key) const;
+
+    [[nodiscard]] int size() const;
+
+    [[nodiscard]] int capacity() const;
+
+    [[nodiscard]] long long hits() const;
+
+    [[nodiscard]] long long misses() const;
+
+    [[nodiscard]] long long evictions() const;
+
+    // fraction of get() calls that were hits, 0 if get() hasn't been called
+    [[nodiscard]] double hitRate() const;
+
+    void resetStats();
+
+private:
+    // slot where key would start probing
+    std::size_t homeSlot(const K &key) const;
+
+    // slot holding key, or the empty slot where it would go
+    std::size_t findSlot(const K &key) const;
+
+    // empty a slot and shift later entries back so probing still finds them
+    void clearSlot(std::size_t i);
+
+    static bool isEmpty(const ListIterator &it);
+};
+
+template<typename K, typename V, typename Hash>
+LruCache<K, V, Hash>::LruCache(int capacity) : capacity_{capacity} {
+    if (capacity < 1) {
+        throw std::invalid_argument("LruCache capacity must be at least 1");
+    }
+    // Keep the table at most half full, so probe sequences stay short.
+    slots.resize(probeTableSize(static_cast<std::size_t>(capacity)));
+    mask = slots.size() - 1;
+}
+
+template<typename K, typename V, typename Hash>
+V *LruCache<K, V, Hash>::get(const K &key) {
+    ListIterator it = slots[findSlot(key)];
+    if (isEmpty(it)) {
+        ++misses_;
+        return nullptr;
+    }
+    ++hits_;
+    entries.move_to_front(it);  // Iterators stay valid, so the index doesn't need updating
+    return &it->second;
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::put(const K &key, V value) {
+    std::size_t i = findSlot(key);
+    if (not isEmpty(slots[i])) {
+        // Already cached, so just update the value and mark it used.
+        slots[i]->second = std::move(value);
+        entries.move_to_front(slots[i]);
+        return;
+    }
+    if (not spare.empty()) {
+        // Reuse a node from an erased entry.
+        ListIterator node = spare.begin();
+        node->first = key;
+        node->second = std::move(value);
+        entries.splice(entries.begin(), spare, node);
+        slots[i] = entries.begin();
+        return;
+    }
+    if (entries.size() < capacity_) {
+        entries.push_front(Entry{key, std::move(value)});
+        slots[i] = entries.begin();
+        return;
+    }
+    // Full: recycle the least recently used node for the new entry instead of deleting it.
+    ListIterator victim = --entries.end();
+    clearSlot(findSlot(victim->first));
+    ++evictions_;
+    victim->first = key;
+    victim->second = std::move(value);
+    entries.move_to_front(victim);
+    // Clearing the victim's slot may have shifted entries around, so probe again.
+    slots[findSlot(key)] = victim;
+}
+
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::erase(const K &key) {
+    std::size_t i = findSlot(key);
+    if (isEmpty(slots[i])) return false;
+    spare.splice(spare.begin(), entries, slots[i]);
+    clearSlot(i);
+    return true;
+}
+
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::contains(const K &key) const {
+    return not isEmpty(slots[findSlot(key)]);
+}
+
+template<typename K, typename V, typename Hash>
+int LruCache<K, V, Hash>::size() const {
+    return entries.size();
+}
+
+template<typename K, typename V, typename Hash>
+int LruCache<K, V, Hash>::capacity() const {
+    return capacity_;
+}
+
+template<typename K, typename V, typename Hash>
+long long LruCache<K, V, Hash>::hits() const {
+    return hits_;
+}
+
+template<typename K, typename V, typename Hash>
+long long LruCache<K, V, Hash>::misses() const {
+    return misses_;
+}
+
+template<typename K, typename V, typename Hash>
+long long LruCache<K, V, Hash>::evictions() const {
+    return evictions_;
+}
+
+template<typename K, typename V, typename Hash>
+double LruCache<K, V, Hash>::hitRate() const {
+    long long lookups = hits_ + misses_;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits_) / static_cast<double>(lookups);
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::resetStats() {
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+}
+
+template<typename K, typename V, typename Hash>
+std::size_t LruCache<K, V, Hash>::homeSlot(const K &key) const {
+    return hasher(key) & mask;
+}
+
+template<typename K, typename V, typename Hash>
+std::size_t LruCache<K, V, Hash>::findSlot(const K &key) const {
+    return probeFind(slots, homeSlot(key), [&](const ListIterator &it) { return it->first == key; });
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::clearSlot(std::size_t i) {
+    probeErase(slots, i, [&](const ListIterator &it) { return homeSlot(it->first); }, [](std::size_t) {});
+}
+
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::isEmpty(const ListIterator &it) {
+    return it == ListIterator{};
+}
+
+#endif  // LRU_CACHE_HPP_
@@ -0,0 +1,57 @@
+#ifndef LINEAR_PROBING_HPP_
+#define LINEAR_PROBING_HPP_
+
+#include <cstddef>
+#include <vector>
+
+// Helpers for a flat open addressing hash table with linear probing, shared by
+// SparseIndexPriorityQueue and LruCache.
+//
+// The table is a std::vector<Slot> whose size is a power of two, and a slot is empty
+// exactly when it equals a value-initialised Slot (0 for an int, a default iterator...).
+// The table must never be full, so every probe sequence ends at an empty slot.
+
+// Smallest power of two (at least 8) that keeps `live` entries at most half full
+inline std::size_t probeTableSize(std::size_t live) {
+    std::size_t tableSize = 8;
+    while (tableSize < 2 * live) {
+        tableSize *= 2;
+    }
+    return tableSize;
+}
+
+// Walk forward from `home` until matches(slot) is true or we reach a gap.
+// Returns the slot holding the entry, or the empty slot where it would be inserted.
+template<typename Slot, typename Matches>
+std::size_t probeFind(const std::vector<Slot> &slots, std::size_t home, Matches matches) {
+    std::size_t mask = slots.size() - 1;
+    std::size_t i = home;
+    while (not (slots[i] == Slot{}) and not matches(slots[i])) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+// Empty slot i using backward shift deletion, so the table never needs tombstones.
+// homeOf(slot) gives the home slot of an entry. onMove(j) is called after an entry is moved into slot j.
+template<typename Slot, typename HomeOf, typename OnMove>
+void probeErase(std::vector<Slot> &slots, std::size_t i, HomeOf homeOf, OnMove onMove) {
+    std::size_t mask = slots.size() - 1;
+    std::size_t j = i;
+    while (true) {
+        j = (j + 1) & mask;
+        if (slots[j] == Slot{}) break;
+        // Any entry after the gap whose home slot is cyclically outside (i, j] would be
+        // cut off from its home by the gap, so move it back into the gap.
+        std::size_t home = homeOf(slots[j]);
+        bool canMove = (i <= j) ? (home <= i or home > j) : (home <= i and home > j);
+        if (canMove) {
+            slots[i] = slots[j];
+            onMove(i);
+            i = j;
+        }
+    }
+    slots[i] = Slot{};
+}
+
+#endif  // LINEAR_PROBING_HPP_
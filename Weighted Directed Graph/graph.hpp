@@ -1,6 +1,8 @@
 #ifndef GRAPH_HPP_
 #define GRAPH_HPP_
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <utility>
@@ -8,6 +10,7 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include <random>
 #include <set>
 #include <unordered_map>
 #include <limits>
@@ -216,6 +219,613 @@ bool allEdgesRelaxed(const std::vector<T> &bestDistanceTo, const Graph<T> &G, in
     return true;    // All edges are relaxed!
 }
 
+// Precomputed answers to "is there a path from u to v?" for a graph that rarely changes.
+//
+// Vertices are first grouped into strongly connected components (SCCs), since every vertex
+// in an SCC reaches exactly the same vertices. Components are numbered in the order Tarjan's
+// algorithm finishes them, so every edge between two components goes from a higher number
+// to a lower one. Then, on the condensation (one vertex per component):
+//      - up to maxBitsetComponents components, each component stores a bitset of every
+//        component it reaches, and reachable() is a single bit test.
+//      - above that, the bitsets would be too big, so each component stores O(1) labels instead:
+//          - which of up to 256 landmark components it reaches, and which reach it, as two
+//            bitmasks. If u reaches a landmark that reaches v, u reaches v.
+//            If v reaches a landmark u doesn't (or a landmark reaches u but not v), u can't reach v.
+//          - an interval from a DFS spanning forest. If v's interval is inside u's, v is in
+//            u's subtree, so u reaches v.
+//          - labelCount GRAIL-style intervals, each from a DFS with a different random child
+//            order. If u reaches v, v's interval is inside u's in every one of them, so a
+//            single labelling without containment proves u does not reach v.
+//          - the component numbers: u can't reach a component with a higher number.
+//        Most queries are settled by these in O(landmarkWords + labelCount) time. The rest fall
+//        back to a DFS that checks the same labels at every step to skip components that can't
+//        lead to v. In the worst case that DFS is still O(C + E), where C is the number of
+//        components and E the number of edges between them. Raise maxBitsetComponents or
+//        labelCount if that matters more than memory.
+//
+// The index keeps a reference to the graph. After G.addEdge(i, j, w), call edgeAdded(i, j)
+// to update it. After G.removeEdge, call rebuild().
+//      - In bitset mode, edgeAdded costs O(C * C / 64). It only rebuilds when the edge closes
+//        a cycle, which merges components.
+//      - In interval mode, edgeAdded costs two reachable() queries, plus walks over the new
+//        edge's ancestors and descendants whose labels actually change. The landmark masks are
+//        always kept exact. A GRAIL labelling that can't be patched in place is switched off,
+//        and so is the component number check if the edge goes to a higher number. Both stay
+//        off until the next rebuild(), so queries slow down somewhat as edges pile up. A full
+//        rebuild (Tarjan + every label, O((labelCount + landmarkWords) * (V + E))) only happens
+//        when the edge closes a cycle. On a large graph it is best to add a batch of edges
+//        without the index and then call rebuild() once.
+//
+// reachable() can be called from several threads at once, as long as nothing calls rebuild()
+// or edgeAdded() (or changes the graph) at the same time. Each thread has its own DFS scratch space.
+template<typename T>
+class ReachabilityIndex {
+private:
+    const Graph<T> &graph;
+    int maxBitsetComponents{};
+    int labelCount{};
+    // component.at(v) is the SCC of vertex v
+    std::vector<int> component{};
+    int numComponents{};
+    // condensation: successors.at(c) are the components with an edge from c (no duplicates)
+    std::vector<std::vector<int> > successors{};
+
+    // -- bitset mode --
+    bool useBitsets{};
+    int wordsPerRow{};
+    // closure[c * wordsPerRow + w] holds bits 64w .. 64w + 63 of the set of components c reaches
+    std::vector<std::uint64_t> closure{};
+
+    // -- interval mode --
+    // the reverse of successors, used to patch labels when an edge is added
+    std::vector<std::vector<int> > predecessors{};
+    // landmark masks are landmarkWords words per component, so up to 64 * landmarkWords landmarks.
+    // bit l of component c's row in reachesLandmark is set if c reaches landmark l,
+    // and in reachedByLandmark if landmark l reaches c
+    static constexpr int landmarkWords = 4;
+    std::vector<std::uint64_t> reachesLandmark{};
+    std::vector<std::uint64_t> reachedByLandmark{};
+    // spanning forest: c reaches every component d with treeLow.at(c) <= treePost.at(d) <= treePost.at(c)
+    std::vector<int> treeLow{};
+    std::vector<int> treePost{};
+    // GRAIL labelling k of component c is [labelLow[k * C + c], labelPost[k * C + c]].
+    // If c reaches d, labelling k of d is inside labelling k of c (for every valid k).
+    std::vector<int> labelLow{};
+    std::vector<int> labelPost{};
+    std::vector<bool> labelValid{};
+    // true while every condensation edge still goes from a higher component number to a lower one
+    bool topoValid{};
+
+    // per thread scratch space for the fallback DFS. marks.at(c) == stamp means visited in this query.
+    // Unsigned so the stamp wraps around to 0 instead of overflowing.
+    struct SearchScratch {
+        std::vector<unsigned> marks{};
+        std::vector<int> stack{};
+        unsigned stamp{};
+    };
+
+public:
+    explicit ReachabilityIndex(const Graph<T> &G, int bitsetLimit = 1 << 14, int labellings = 2);
+
+    // recompute the whole index from the graph
+    void rebuild();
+
+    // update the index after G.addEdge(i, j, weight)
+    void edgeAdded(int i, int j);
+
+    // is there a path from u to v? A vertex always reaches itself.
+    // throws std::out_of_range for an invalid vertex number
+    bool reachable(int u, int v) const;
+
+    // the strongly connected component of vertex v
+    int componentOf(int v) const;
+
+    int componentCount() const;
+
+private:
+    void findComponents();
+
+    void buildBitsets();
+
+    void buildIntervals();
+
+    void buildLandmarks();
+
+    // add the landmark bits for a new edge from -> to
+    void patchLandmarks(int from, int to);
+
+    static std::uint64_t *landmarkRow(std::vector<std::uint64_t> &masks, int c);
+
+    static const std::uint64_t *landmarkRow(const std::vector<std::uint64_t> &masks, int c);
+
+    static void landmarkUnion(std::uint64_t *into, const std::uint64_t *bits);
+
+    // is every bit of bits also set in of?
+    static bool landmarkSubset(const std::uint64_t *bits, const std::uint64_t *of);
+
+    static bool landmarkOverlap(const std::uint64_t *a, const std::uint64_t *b);
+
+    // DFS with the given child order to fill in labelling k (and the spanning forest when k is 0)
+    void buildLabelling(int k);
+
+    // patch labelling k for a new edge from -> to, returning false if it can't be patched
+    bool patchLabelling(int k, int from, int to);
+
+    bool closureHas(int from, int to) const;
+
+    // true if a landmark or the spanning forest proves from reaches to
+    bool surelyReaches(int from, int to) const;
+
+    // false if some label proves from can't reach to
+    bool mayReach(int from, int to) const;
+
+    bool searchIntervals(int from, int to) const;
+
+    static SearchScratch &scratch();
+};
+
+template<typename T>
+ReachabilityIndex<T>::ReachabilityIndex(const Graph<T> &G, int bitsetLimit, int labellings) :
+        graph{G}, maxBitsetComponents{bitsetLimit}, labelCount{std::max(labellings, 1)} {
+    rebuild();
+}
+
+template<typename T>
+void ReachabilityIndex<T>::rebuild() {
+    findComponents();
+    useBitsets = numComponents <= maxBitsetComponents;
+    if (useBitsets) {
+        buildBitsets();
+        predecessors.clear();
+        reachesLandmark.clear();
+        reachedByLandmark.clear();
+        treeLow.clear();
+        treePost.clear();
+        labelLow.clear();
+        labelPost.clear();
+        labelValid.clear();
+    } else {
+        buildIntervals();
+        closure.clear();
+    }
+}
+
+template<typename T>
+void ReachabilityIndex<T>::edgeAdded(int i, int j) {
+    int from = componentOf(i);
+    int to = componentOf(j);
+    if (from == to) return;    // Inside one SCC, nothing changes
+    if (useBitsets) {
+        if (closureHas(from, to)) return;       // Already reachable, nothing changes
+        if (closureHas(to, from)) {             // New cycle, so components merge and we start over
+            rebuild();
+            return;
+        }
+        successors[from].push_back(to);
+        // Everything that reaches `from` now also reaches everything `to` reaches.
+        const std::uint64_t *toRow = &closure[static_cast<std::size_t>(to) * wordsPerRow];
+        for (int c = 0; c < numComponents; ++c) {
+            if (not closureHas(c, from)) continue;
+            std::uint64_t *row = &closure[static_cast<std::size_t>(c) * wordsPerRow];
+            for (int w = 0; w < wordsPerRow; ++w) {
+                row[w] |= toRow[w];
+            }
+        }
+        return;
+    }
+    // Interval mode
+    if (searchIntervals(from, to)) return;      // Already reachable, nothing changes
+    if (searchIntervals(to, from)) {            // New cycle, so components merge and we start over
+        rebuild();
+        return;
+    }
+    successors[from].push_back(to);
+    predecessors[to].push_back(from);
+    patchLandmarks(from, to);
+    // The spanning forest only ever says "reachable", and that stays true with more edges.
+    // The component numbers stop being topological if the edge goes up.
+    if (to > from) topoValid = false;
+    // A labelling that can't be patched is switched off until the next rebuild. The landmark
+    // masks stay exact, so queries get somewhat slower but never wrong.
+    for (int k = 0; k < labelCount; ++k) {
+        if (labelValid[k] and not patchLabelling(k, from, to)) {
+            labelValid[k] = false;
+        }
+    }
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::reachable(int u, int v) const {
+    int from = componentOf(u);
+    int to = componentOf(v);
+    if (from == to) return true;
+    if (useBitsets) return closureHas(from, to);
+    return searchIntervals(from, to);
+}
+
+template<typename T>
+int ReachabilityIndex<T>::componentOf(int v) const {
+    if (v < 0 or v >= static_cast<int>(component.size())) {
+        throw std::out_of_range("invalid vertex number");
+    }
+    return component[v];
+}
+
+template<typename T>
+int ReachabilityIndex<T>::componentCount() const {
+    return numComponents;
+}
+
+// Tarjan's SCC algorithm, written with an explicit stack so deep graphs can't overflow the call stack.
+template<typename T>
+void ReachabilityIndex<T>::findComponents() {
+    int n = graph.size();
+    component.assign(n, -1);
+    numComponents = 0;
+    std::vector<int> order(n, -1);      // order in which DFS first reached each vertex
+    std::vector<int> lowLink(n, 0);     // smallest order reachable through the DFS subtree
+    std::vector<bool> onStack(n, false);
+    std::vector<int> sccStack{};
+    using EdgeIterator = typename std::unordered_map<int, T>::const_iterator;
+    std::vector<std::pair<int, EdgeIterator> > callStack{};
+    int counter = 0;
+
+    for (int start = 0; start < n; ++start) {
+        if (order[start] != -1) continue;
+        order[start] = lowLink[start] = counter++;
+        sccStack.push_back(start);
+        onStack[start] = true;
+        callStack.emplace_back(start, graph.neighbours(start)->begin());
+        while (not callStack.empty()) {
+            auto &[vertex, edge] = callStack.back();
+            if (edge != graph.neighbours(vertex)->end()) {
+                int neighbour = edge->first;
+                ++edge;
+                if (order[neighbour] == -1) {
+                    // Not visited yet: "recurse" into it
+                    order[neighbour] = lowLink[neighbour] = counter++;
+                    sccStack.push_back(neighbour);
+                    onStack[neighbour] = true;
+                    callStack.emplace_back(neighbour, graph.neighbours(neighbour)->begin());
+                } else if (onStack[neighbour]) {
+                    lowLink[vertex] = std::min(lowLink[vertex], order[neighbour]);
+                }
+                continue;
+            }
+            // All edges done. If vertex is the root of an SCC, pop the whole SCC off the stack.
+            int finished = vertex;
+            callStack.pop_back();
+            if (lowLink[finished] == order[finished]) {
+                int member{};
+                do {
+                    member = sccStack.back();
+                    sccStack.pop_back();
+                    onStack[member] = false;
+                    component[member] = numComponents;
+                } while (member != finished);
+                ++numComponents;
+            }
+            if (not callStack.empty()) {
+                int caller = callStack.back().first;
+                lowLink[caller] = std::min(lowLink[caller], lowLink[finished]);
+            }
+        }
+    }
+
+    successors.assign(numComponents, {});
+    for (int vertex = 0; vertex < n; ++vertex) {
+        for (const auto &[neighbour, weight]: *graph.neighbours(vertex)) {
+            if (component[vertex] != component[neighbour]) {
+                successors[component[vertex]].push_back(component[neighbour]);
+            }
+        }
+    }
+    for (auto &next: successors) {
+        std::sort(next.begin(), next.end());
+        next.erase(std::unique(next.begin(), next.end()), next.end());
+    }
+}
+
+template<typename T>
+void ReachabilityIndex<T>::buildBitsets() {
+    wordsPerRow = (numComponents + 63) / 64;
+    closure.assign(static_cast<std::size_t>(numComponents) * wordsPerRow, 0);
+    // Successors always have a lower number, so going up from 0 every successor's row is finished
+    // before we need it. The inner loop is a plain OR over words, which the compiler vectorises.
+    for (int c = 0; c < numComponents; ++c) {
+        std::uint64_t *row = &closure[static_cast<std::size_t>(c) * wordsPerRow];
+        row[c / 64] |= std::uint64_t{1} << (c % 64);
+        for (int next: successors[c]) {
+            const std::uint64_t *nextRow = &closure[static_cast<std::size_t>(next) * wordsPerRow];
+            for (int w = 0; w < wordsPerRow; ++w) {
+                row[w] |= nextRow[w];
+            }
+        }
+    }
+}
+
+template<typename T>
+void ReachabilityIndex<T>::buildIntervals() {
+    predecessors.assign(numComponents, {});
+    for (int c = 0; c < numComponents; ++c) {
+        for (int next: successors[c]) {
+            predecessors[next].push_back(c);
+        }
+    }
+    treeLow.assign(numComponents, -1);
+    treePost.assign(numComponents, -1);
+    labelLow.assign(static_cast<std::size_t>(labelCount) * numComponents, -1);
+    labelPost.assign(static_cast<std::size_t>(labelCount) * numComponents, -1);
+    labelValid.assign(labelCount, true);
+    topoValid = true;
+    buildLandmarks();
+    for (int k = 0; k < labelCount; ++k) {
+        buildLabelling(k);
+    }
+}
+
+template<typename T>
+void ReachabilityIndex<T>::buildLandmarks() {
+    // Landmarks are a fixed-seed random sample of the components with edges both in and out
+    // (a source or a sink can't be in the middle of a path). On graphs without obvious hubs
+    // this covered far more paths than picking the highest degree components.
+    std::vector<int> candidates{};
+    for (int c = 0; c < numComponents; ++c) {
+        if (not predecessors[c].empty() and not successors[c].empty()) candidates.push_back(c);
+    }
+    std::mt19937 rng(12345u);
+    std::shuffle(candidates.begin(), candidates.end(), rng);
+    int landmarks = std::min(static_cast<int>(candidates.size()), 64 * landmarkWords);
+
+    reachesLandmark.assign(static_cast<std::size_t>(numComponents) * landmarkWords, 0);
+    reachedByLandmark.assign(static_cast<std::size_t>(numComponents) * landmarkWords, 0);
+    for (int l = 0; l < landmarks; ++l) {
+        std::size_t word = static_cast<std::size_t>(candidates[l]) * landmarkWords + l / 64;
+        reachesLandmark[word] |= std::uint64_t{1} << (l % 64);
+        reachedByLandmark[word] |= std::uint64_t{1} << (l % 64);
+    }
+    // Successors have lower numbers, so going up from 0 they are always done before we need them...
+    for (int c = 0; c < numComponents; ++c) {
+        for (int next: successors[c]) {
+            landmarkUnion(landmarkRow(reachesLandmark, c), landmarkRow(reachesLandmark, next));
+        }
+    }
+    // ...and going down from the top, every predecessor is done before its successors.
+    for (int c = numComponents - 1; c >= 0; --c) {
+        for (int next: successors[c]) {
+            landmarkUnion(landmarkRow(reachedByLandmark, next), landmarkRow(reachedByLandmark, c));
+        }
+    }
+}
+
+template<typename T>
+void ReachabilityIndex<T>::patchLandmarks(int from, int to) {
+    // `from` and everything reaching it now reach every landmark `to` reaches. Walk up, stopping
+    // where the bits are already there (the ancestors of that component have them too).
+    // `to` can't be an ancestor of `from` (that would be a cycle), so its row doesn't change under us.
+    const std::uint64_t *gained = landmarkRow(reachesLandmark, to);
+    std::vector<int> stack{};
+    if (not landmarkSubset(gained, landmarkRow(reachesLandmark, from))) {
+        landmarkUnion(landmarkRow(reachesLandmark, from), gained);
+        stack.push_back(from);
+    }
+    while (not stack.empty()) {
+        int c = stack.back();
+        stack.pop_back();
+        for (int previous: predecessors[c]) {
+            if (not landmarkSubset(gained, landmarkRow(reachesLandmark, previous))) {
+                landmarkUnion(landmarkRow(reachesLandmark, previous), gained);
+                stack.push_back(previous);
+            }
+        }
+    }
+    // Likewise every landmark reaching `from` now reaches `to` and everything after it.
+    gained = landmarkRow(reachedByLandmark, from);
+    if (not landmarkSubset(gained, landmarkRow(reachedByLandmark, to))) {
+        landmarkUnion(landmarkRow(reachedByLandmark, to), gained);
+        stack.push_back(to);
+    }
+    while (not stack.empty()) {
+        int c = stack.back();
+        stack.pop_back();
+        for (int next: successors[c]) {
+            if (not landmarkSubset(gained, landmarkRow(reachedByLandmark, next))) {
+                landmarkUnion(landmarkRow(reachedByLandmark, next), gained);
+                stack.push_back(next);
+            }
+        }
+    }
+}
+
+template<typename T>
+std::uint64_t *ReachabilityIndex<T>::landmarkRow(std::vector<std::uint64_t> &masks, int c) {
+    return &masks[static_cast<std::size_t>(c) * landmarkWords];
+}
+
+template<typename T>
+const std::uint64_t *ReachabilityIndex<T>::landmarkRow(const std::vector<std::uint64_t> &masks, int c) {
+    return &masks[static_cast<std::size_t>(c) * landmarkWords];
+}
+
+template<typename T>
+void ReachabilityIndex<T>::landmarkUnion(std::uint64_t *into, const std::uint64_t *bits) {
+    for (int w = 0; w < landmarkWords; ++w) {
+        into[w] |= bits[w];
+    }
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::landmarkSubset(const std::uint64_t *bits, const std::uint64_t *of) {
+    for (int w = 0; w < landmarkWords; ++w) {
+        if ((bits[w] & ~of[w]) != 0) return false;
+    }
+    return true;
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::landmarkOverlap(const std::uint64_t *a, const std::uint64_t *b) {
+    for (int w = 0; w < landmarkWords; ++w) {
+        if ((a[w] & b[w]) != 0) return true;
+    }
+    return false;
+}
+
+template<typename T>
+void ReachabilityIndex<T>::buildLabelling(int k) {
+    int *lowK = &labelLow[static_cast<std::size_t>(k) * numComponents];
+    int *postK = &labelPost[static_cast<std::size_t>(k) * numComponents];
+    // Labelling 0 starts from the highest numbers (which include all the sources) so the spanning
+    // forest trees are as big as possible. The others use a fixed-seed random order, so each one
+    // cuts off different pairs but rebuilding always gives the same index.
+    std::vector<int> roots(numComponents);
+    for (int c = 0; c < numComponents; ++c) {
+        roots[c] = numComponents - 1 - c;
+    }
+    std::mt19937 rng(static_cast<unsigned>(k));
+    if (k > 0) std::shuffle(roots.begin(), roots.end(), rng);
+
+    std::vector<bool> entered(numComponents, false);
+    int counter = 0;
+    // (component, first successor to look at, number of successors looked at so far)
+    struct Frame {
+        int c;
+        int first;
+        int seen;
+    };
+    std::vector<Frame> callStack{};
+    auto enter = [&](int c) {
+        entered[c] = true;
+        if (k == 0) treeLow[c] = counter;
+        int degree = static_cast<int>(successors[c].size());
+        int first = (k > 0 and degree > 0) ? static_cast<int>(rng() % degree) : 0;
+        callStack.push_back(Frame{c, first, 0});
+    };
+    for (int root: roots) {
+        if (entered[root]) continue;
+        enter(root);
+        while (not callStack.empty()) {
+            Frame &frame = callStack.back();
+            const std::vector<int> &next = successors[frame.c];
+            int degree = static_cast<int>(next.size());
+            if (frame.seen < degree) {
+                int child = next[(frame.first + frame.seen++) % degree];
+                if (not entered[child]) enter(child);
+                continue;
+            }
+            // Every successor has finished (the condensation has no cycles), so their labels are final.
+            int c = frame.c;
+            callStack.pop_back();
+            postK[c] = counter++;
+            lowK[c] = postK[c];
+            for (int child: next) {
+                lowK[c] = std::min(lowK[c], lowK[child]);
+            }
+            if (k == 0) treePost[c] = postK[c];
+        }
+    }
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::patchLabelling(int k, int from, int to) {
+    int *lowK = &labelLow[static_cast<std::size_t>(k) * numComponents];
+    const int *postK = &labelPost[static_cast<std::size_t>(k) * numComponents];
+    // Ancestors of `from` finished after it, and descendants of `to` finished no later than `to`.
+    // So if `to` finished first, every new pair still has the descendant's post number
+    // below the ancestor's, and only the low ends need to move down.
+    if (postK[to] > postK[from]) return false;
+    int newLow = lowK[to];
+    if (lowK[from] <= newLow) return true;
+    // Walk up from `from`, stopping wherever the low end is already small enough
+    // (its ancestors then already have small enough low ends as well).
+    lowK[from] = newLow;
+    std::vector<int> stack{from};
+    while (not stack.empty()) {
+        int c = stack.back();
+        stack.pop_back();
+        for (int previous: predecessors[c]) {
+            if (lowK[previous] > newLow) {
+                lowK[previous] = newLow;
+                stack.push_back(previous);
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::closureHas(int from, int to) const {
+    std::uint64_t word = closure[static_cast<std::size_t>(from) * wordsPerRow + to / 64];
+    return (word >> (to % 64)) & 1;
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::surelyReaches(int from, int to) const {
+    // A path through a landmark, or through the spanning forest
+    if (landmarkOverlap(landmarkRow(reachesLandmark, from), landmarkRow(reachedByLandmark, to))) return true;
+    return treeLow[from] <= treePost[to] and treePost[to] <= treePost[from];
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::mayReach(int from, int to) const {
+    if (topoValid and to > from) return false;      // Edges only go to lower numbers
+    // A landmark reached by `to` but not `from`, or reaching `from` but not `to`
+    if (not landmarkSubset(landmarkRow(reachesLandmark, to), landmarkRow(reachesLandmark, from))) return false;
+    if (not landmarkSubset(landmarkRow(reachedByLandmark, from), landmarkRow(reachedByLandmark, to))) return false;
+    for (int k = 0; k < labelCount; ++k) {
+        std::size_t offset = static_cast<std::size_t>(k) * numComponents;
+        if (labelValid[k] and (labelLow[offset + to] < labelLow[offset + from] or
+                               labelPost[offset + to] > labelPost[offset + from])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool ReachabilityIndex<T>::searchIntervals(int from, int to) const {
+    if (not mayReach(from, to)) return false;
+    if (surelyReaches(from, to)) return true;
+    // Neither shortcut decided it, so DFS, skipping anything that can't lead to `to`.
+    SearchScratch &s = scratch();
+    if (s.marks.size() < static_cast<std::size_t>(numComponents)) {
+        s.marks.assign(numComponents, 0);
+        s.stamp = 0;
+    }
+    if (++s.stamp == 0) {
+        // The stamp wrapped around, so old marks could look current. Clear them.
+        std::fill(s.marks.begin(), s.marks.end(), 0);
+        s.stamp = 1;
+    }
+    s.stack.clear();
+    s.stack.push_back(from);
+    s.marks[from] = s.stamp;
+    while (not s.stack.empty()) {
+        int c = s.stack.back();
+        s.stack.pop_back();
+        // Successors are sorted, so go backwards to push the lowest numbered (closest to `to`) last,
+        // which makes it the next one we look at.
+        const std::vector<int> &nexts = successors[c];
+        for (auto it = nexts.rbegin(); it != nexts.rend(); ++it) {
+            int next = *it;
+            if (next == to) return true;
+            if (s.marks[next] == s.stamp) continue;
+            s.marks[next] = s.stamp;
+            if (not mayReach(next, to)) continue;
+            if (surelyReaches(next, to)) return true;
+            s.stack.push_back(next);
+        }
+    }
+    return false;
+}
+
+// Scratch space is per thread, so concurrent queries never share it. Every index on the thread
+// shares it, which is fine: marks left behind by another index are always older than the current stamp.
+template<typename T>
+typename ReachabilityIndex<T>::SearchScratch &ReachabilityIndex<T>::scratch() {
+    thread_local SearchScratch s{};
+    return s;
+}
+
 //template <typename T>
 //T infinity() {
 //    if (std::numeric_limits<T>::has_infinity) {